@@ -9,6 +9,9 @@ ogre/lod/lodstrategymanager.d ^
 ogre/lod/pixelcountlodstrategy.d ^
 ogre/exception.d ^
 ogre/threading/defaultworkqueuestandard.d ^
+ogre/threading/taskscheduler.d ^
+ogre/threading/lockfree.d ^
+ogre/threading/lockfreeworkqueue.d ^
 ogre/any.d ^
 ogre/compat.d ^
 ogre/strings.d ^
@@ -25,8 +28,10 @@ ogre/math/polygon.d ^
 ogre/math/bitwise.d ^
 ogre/math/dualquaternion.d ^
 ogre/math/axisalignedbox.d ^
+ogre/math/bvh.d ^
 ogre/math/tangentspacecalc.d ^
 ogre/math/optimisedutil.d ^
+ogre/math/optimisedutilsse.d ^
 ogre/math/plane.d ^
 ogre/math/sphere.d ^
 ogre/math/ray.d ^
@@ -42,6 +47,7 @@ ogre/materials/technique.d ^
 ogre/materials/pass.d ^
 ogre/materials/externaltexturesource.d ^
 ogre/general/profiler.d ^
+ogre/general/traceprofiler.d ^
 ogre/general/controller.d ^
 ogre/general/common.d ^
 ogre/general/scriptcompiler.d ^
@@ -62,6 +68,7 @@ ogre/general/colourvalue.d ^
 ogre/general/framelistener.d ^
 ogre/general/dynlibmanager.d ^
 ogre/general/radixsort.d ^
+ogre/general/framearena.d ^
 ogre/general/workqueue.d ^
 ogre/general/predefinedcontrollers.d ^
 ogre/general/controllermanager.d ^
@@ -85,18 +92,24 @@ ogre/effects/compositorlogic.d ^
 ogre/effects/compositor.d ^
 ogre/image/images.d ^
 ogre/image/pixelformat.d ^
+ogre/image/pixelconversions.d ^
 ogre/animation/skeletonserializer.d ^
 ogre/animation/animable.d ^
 ogre/animation/skeletonmanager.d ^
 ogre/animation/animations.d ^
+ogre/animation/animationclip.d ^
+ogre/animation/animationcompression.d ^
+ogre/animation/softwareskinning.d ^
 ogre/resources/resourcemanager.d ^
 ogre/resources/texture.d ^
 ogre/resources/archive.d ^
+ogre/resources/ziparchive.d ^
 ogre/resources/meshserializer.d ^
 ogre/resources/meshfileformat.d ^
 ogre/resources/resourcebackgroundqueue.d ^
 ogre/resources/datastream.d ^
 ogre/resources/mesh.d ^
+ogre/resources/meshbvh.d ^
 ogre/resources/texturemanager.d ^
 ogre/resources/unifiedhighlevelgpuprogram.d ^
 ogre/resources/prefabfactory.d ^
@@ -117,9 +130,13 @@ ogre/scene/instancedgeometry.d ^
 ogre/scene/userobjectbindings.d ^
 ogre/scene/shadowvolumeextrudeprogram.d ^
 ogre/scene/node.d ^
+ogre/scene/nodetransformstore.d ^
+ogre/scene/parallelsceneupdate.d ^
+ogre/scene/parallelanimationupdate.d ^
 ogre/scene/instancemanager.d ^
 ogre/scene/skeletoninstance.d ^
 ogre/scene/movableobject.d ^
+ogre/scene/movableobjectbvh.d ^
 ogre/scene/staticgeometry.d ^
 ogre/scene/instancedentity.d ^
 ogre/scene/scenenode.d ^
@@ -147,7 +164,7 @@ ogre/rendersystem/renderwindow.d ^
 ogre/rendersystem/windoweventutilities.d ^
 ogre/config.d ^
 ogre/singleton.d ^
--debug -version=OGRE_THREAD_SUPPORT_STD -version=OGRE_NO_ZIP_ARCHIVE -version=OGRE_NO_VIEWPORT_ORIENTATIONMODE ^
+-debug -version=OGRE_THREAD_SUPPORT_STD -version=OGRE_NO_VIEWPORT_ORIENTATIONMODE ^
         -I../Deps/DerelictFI -I../Deps/DerelictUtil -Lgdi32.lib -Luser32.lib ^
 		../Deps/DerelictFI/bin/Debug/libDerelictFI.lib ^
         ../Deps/DerelictUtil/bin/Debug/libDerelictUtil.lib
@@ -216,7 +216,7 @@ OgreD\ogre\spotshadowfadepng.d ^
 OgreD\ogre\strings.d ^
 OgreD\ogre\threading\defaultworkqueuestandard.d ^
 %RENDERSYSTEMGL% ^
--version=OGRE_NO_ZIP_ARCHIVE -version=OGRE_NO_VIEWPORT_ORIENTATIONMODE ^
+-version=OGRE_NO_VIEWPORT_ORIENTATIONMODE ^
         -I.\Deps\DerelictFI -I.\Deps\DerelictUtil -I.\Deps\DerelictGL3 ^
 		-I.\RenderSystems\GL -I.\OgreD ^
 		.\Deps\DerelictFI\bin\Debug\libDerelictFI.lib ^
@@ -16,7 +16,7 @@ echo LIBS=-L-lX11 -L-ldl -L-lXaw -L-lXt  \
 		../DerelictFI/bin/Unittest/libDerelictFI.a \
 		../DerelictUtil/bin/Unittest/libDerelictUtil.a
 
-echo DFLAGS=-debug -version=OGRE_THREAD_SUPPORT_STD -version=OGRE_NO_ZIP_ARCHIVE -version=OGRE_NO_VIEWPORT_ORIENTATIONMODE \
+echo DFLAGS=-debug -version=OGRE_THREAD_SUPPORT_STD -version=OGRE_NO_VIEWPORT_ORIENTATIONMODE \
 	-I../DerelictFI -I../DerelictUtil
 
 